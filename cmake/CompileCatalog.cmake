@@ -0,0 +1,134 @@
+# validates a catalog text file and turns it into constexpr tables
+# usage: cmake -DCATALOG_FILE=<catalog.txt> -DOUTPUT_FILE=<CompiledCatalog.h> -P cmake/CompileCatalog.cmake
+# any malformed entry stops with FATAL_ERROR, which fails the build step that runs this script
+cmake_minimum_required(VERSION 3.18)
+
+if(NOT DEFINED CATALOG_FILE OR NOT DEFINED OUTPUT_FILE)
+    message(FATAL_ERROR "CompileCatalog: CATALOG_FILE and OUTPUT_FILE must be set")
+endif()
+
+# same keys GameManager::loadFromFile understands; every entry must define all of them exactly once
+set(NAME_KEYS foodName courierName)
+set(NUMBER_KEYS baseIncome upgradeCost incomeMultiplier upgradeMultiplier unlockFoodCost unlockDeliveryCost)
+# Display selects items with keys 1-9; emitted as MAX_CATALOG_ITEMS so C++ code shares the limit
+set(MAX_ITEMS 9)
+
+file(READ "${CATALOG_FILE}" content)
+if(content MATCHES ";")
+    message(FATAL_ERROR "${CATALOG_FILE}: ';' is not allowed in the catalog")
+endif()
+string(REPLACE "\r" "" content "${content}")
+# CMake does not split list items inside an unbalanced '[', so brackets (valid in names for
+# loadFromFile) are swapped for control characters while splitting and restored per line
+string(ASCII 1 OPEN_BRACKET)
+string(ASCII 2 CLOSE_BRACKET)
+if(content MATCHES "[${OPEN_BRACKET}${CLOSE_BRACKET}]")
+    message(FATAL_ERROR "${CATALOG_FILE}: control characters are not allowed in the catalog")
+endif()
+string(REPLACE "[" "${OPEN_BRACKET}" content "${content}")
+string(REPLACE "]" "${CLOSE_BRACKET}" content "${content}")
+# trailing empty line closes the last entry, like the end-of-file handling in loadFromFile
+string(REPLACE "\n" ";" lines "${content};")
+
+set(entries "")
+set(item_count 0)
+set(line_number 0)
+set(entry_start 0)
+set(entry_keys "")
+
+macro(close_entry)
+    if(entry_keys)
+        foreach(key IN LISTS NAME_KEYS NUMBER_KEYS)
+            if(NOT key IN_LIST entry_keys)
+                message(FATAL_ERROR "${CATALOG_FILE}:${entry_start}: entry is missing '${key}'")
+            endif()
+        endforeach()
+
+        math(EXPR item_count "${item_count} + 1")
+        if(item_count GREATER MAX_ITEMS)
+            message(FATAL_ERROR "${CATALOG_FILE}:${entry_start}: at most ${MAX_ITEMS} food items are supported")
+        endif()
+
+        string(APPEND entries "    CompiledCatalogEntry{\"${value_foodName}\", ${value_baseIncome}, ${value_upgradeCost}, "
+            "${value_incomeMultiplier}, ${value_upgradeMultiplier}, ${value_unlockFoodCost}, "
+            "\"${value_courierName}\", ${value_unlockDeliveryCost}},\n")
+        set(entry_keys "")
+    endif()
+endmacro()
+
+foreach(line IN LISTS lines)
+    math(EXPR line_number "${line_number} + 1")
+    string(REPLACE "${OPEN_BRACKET}" "[" line "${line}")
+    string(REPLACE "${CLOSE_BRACKET}" "]" line "${line}")
+
+    if(line STREQUAL "")
+        close_entry()
+        continue()
+    endif()
+
+    if(NOT line MATCHES "^([^:]*):[ ]?(.*)$")
+        message(FATAL_ERROR "${CATALOG_FILE}:${line_number}: expected 'key: value', got '${line}'")
+    endif()
+    set(key "${CMAKE_MATCH_1}")
+    set(value "${CMAKE_MATCH_2}")
+
+    if(NOT entry_keys)
+        set(entry_start ${line_number})
+    endif()
+    if(key IN_LIST entry_keys)
+        message(FATAL_ERROR "${CATALOG_FILE}:${line_number}: '${key}' is defined twice in the same entry")
+    endif()
+
+    if(key IN_LIST NAME_KEYS)
+        if(value STREQUAL "" OR value MATCHES "[\"\\\\]")
+            message(FATAL_ERROR "${CATALOG_FILE}:${line_number}: '${key}' must be a non-empty name without quotes or backslashes")
+        endif()
+    elseif(key IN_LIST NUMBER_KEYS)
+        if(NOT value MATCHES "^[0-9]+(\\.[0-9]+)?([eE][+-]?[0-9]+)?$")
+            message(FATAL_ERROR "${CATALOG_FILE}:${line_number}: '${key}' must be a non-negative number, got '${value}'")
+        endif()
+        # keep the literal a double, e.g. "5" -> "5.0"
+        if(NOT value MATCHES "[.eE]")
+            string(APPEND value ".0")
+        endif()
+    else()
+        message(FATAL_ERROR "${CATALOG_FILE}:${line_number}: unknown key '${key}'")
+    endif()
+
+    set(value_${key} "${value}")
+    list(APPEND entry_keys ${key})
+endforeach()
+
+if(item_count EQUAL 0)
+    message(FATAL_ERROR "${CATALOG_FILE}: catalog has no food items")
+endif()
+
+set(header "// Generated by cmake/CompileCatalog.cmake from ${CATALOG_FILE}; do not edit.
+#ifndef OOP_COMPILEDCATALOG_H
+#define OOP_COMPILEDCATALOG_H
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+// Display selects items with keys 1-9
+inline constexpr std::size_t MAX_CATALOG_ITEMS = ${MAX_ITEMS};
+
+struct CompiledCatalogEntry {
+    std::string_view foodName;
+    double baseIncome;
+    double upgradeCost;
+    double incomeMultiplier;
+    double upgradeMultiplier;
+    double unlockFoodCost;
+    std::string_view courierName;
+    double unlockDeliveryCost;
+};
+
+inline constexpr std::array COMPILED_CATALOG{
+${entries}};
+
+#endif //OOP_COMPILEDCATALOG_H
+")
+
+file(WRITE "${OUTPUT_FILE}" "${header}")
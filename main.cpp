@@ -6,7 +6,7 @@
 #include "src/GameManager.h"
 #include "src/Display.h"
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
         Player player("Stoicescu", 0.0);
 
@@ -30,7 +30,9 @@ int main() {
             }
         }
 
-        GameManager gameManager = GameManager::loadFromFile("resources/textfile.txt", player);
+        // The catalog is compiled into the binary; passing a catalog file overrides it
+        GameManager gameManager = argc > 1 ? GameManager::loadFromFile(argv[1], player)
+                                           : GameManager::loadCompiledCatalog(player);
 
         if (saveExists) {
             (void)gameManager.loadSavedGame(); // void for the warning
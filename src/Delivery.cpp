@@ -9,7 +9,7 @@ Delivery::Delivery(const Delivery &delivery)
     : deliveryName(delivery.deliveryName),
       unlockDeliveryCost(delivery.unlockDeliveryCost),
       timeInterval(delivery.timeInterval),
-      running(delivery.running) {
+      running(delivery.running.load()) {
 }
 
 Delivery::~Delivery() { std::cout << "Curierul " << deliveryName << " a fost distrus! \n"; }
@@ -18,6 +18,7 @@ Delivery &Delivery::operator=(const Delivery &delivery) {
     deliveryName = delivery.deliveryName;
     timeInterval = delivery.timeInterval;
     unlockDeliveryCost = delivery.unlockDeliveryCost;
+    running.store(delivery.running.load());
     return *this;
 }
 
@@ -31,6 +32,10 @@ const double &Delivery::getUnlockCost() const {
     return unlockDeliveryCost;
 }
 
+const std::string &Delivery::getName() const {
+    return deliveryName;
+}
+
 sf::Time Delivery::getTimeInterval() const {
     return timeInterval;
 }
@@ -39,6 +44,14 @@ bool Delivery::canUnlock(const Player &player) const {
     return player.getMoney() >= unlockDeliveryCost;
 }
 
+bool Delivery::isRunning() const {
+    return running;
+}
+
+void Delivery::setRunning(const bool running_) {
+    running = running_;
+}
+
 
 
 
@@ -1,6 +1,7 @@
 #ifndef OOP_DELIVERY_H
 #define OOP_DELIVERY_H
 
+#include <atomic>
 #include <SFML/System/Time.hpp>
 #include "Player.h"
 
@@ -8,7 +9,7 @@ class Delivery {
     std::string deliveryName;
     double unlockDeliveryCost;
     sf::Time timeInterval = sf::seconds(2.0f);
-    bool running = false;
+    std::atomic<bool> running = false; // hired and delivering
 
 public:
     Delivery(std::string  name, const double& unlockDeliveryCost_);
@@ -18,8 +19,11 @@ public:
     friend std::ostream& operator<<(std::ostream& ostream, const Delivery& delivery);
 
     [[nodiscard]] bool canUnlock(const Player& player) const;
+    [[nodiscard]] const std::string& getName() const;
     [[nodiscard]] sf::Time getTimeInterval() const;
     [[nodiscard]] const double& getUnlockCost() const;
+    [[nodiscard]] bool isRunning() const;
+    void setRunning(bool running_);
 };
 
 
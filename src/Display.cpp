@@ -1,10 +1,14 @@
 #include "Display.h"
 #include <iostream>
+#include <algorithm>
 
 Display::Display(GameManager &gm, Player &p) : gameManager(gm), player(p) {
-    for (const auto& food : gameManager.getFoods())
-        unlocked.push_back(player.getMoney() >= food.getUnlockCost());
-    unlocked[0] = true; // First item starts unlocked
+    const auto& foods = gameManager.getFoods();
+    for (size_t i = 0; i < foods.size(); ++i)
+        if (i == 0 || player.getMoney() >= foods[i].getUnlockCost()) // First item starts unlocked
+            unlocked.push_back(foods.handleAt(i));
+    if (!foods.empty())
+        selectedFood = foods.handleAt(0);
 
     const sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
     const unsigned int width = desktop.size.x;
@@ -28,7 +32,7 @@ Display &Display::operator=(const Display &other) {
     gameManager = other.gameManager;
     player = other.player;
     lastAction = other.lastAction;
-    selectedIndex = other.selectedIndex;
+    selectedFood = other.selectedFood;
     return *this;
 }
 
@@ -66,63 +70,78 @@ void Display::run() {
                     case Scan::S: lastAction = 's'; break;
                     case Scan::U: lastAction = 'u'; break;
                     case Scan::D: lastAction = 'd'; break;
+                    case Scan::E: exportTelemetry(); break;
+                    case Scan::G: showGraph = !showGraph; break;
                     case Scan::Num1: case Scan::Num2: case Scan::Num3:
                     case Scan::Num4: case Scan::Num5: case Scan::Num6:
                     case Scan::Num7: case Scan::Num8: case Scan::Num9:
-                        selectedIndex = std::min(
-                        (static_cast<int>(keyPressed->scancode) - static_cast<int>(Scan::Num1) + 1),
-                         static_cast<int>(gameManager.getFoods().size()) );
+                    {
+                        if (gameManager.getFoods().empty())
+                            break;
+                        // Keys pick by display order, but the selection is kept as a handle
+                        const size_t position = std::min(
+                            static_cast<size_t>(static_cast<int>(keyPressed->scancode) - static_cast<int>(Scan::Num1)),
+                            gameManager.getFoods().size() - 1);
+                        selectedFood = gameManager.getFoods().handleAt(position);
                         break;
+                    }
                     default: break;
                 }
             }
         }
 
+        // Credit courier sales on this thread, so money is only ever touched by the game loop
+        gameManager.collectDeliveries();
+
         // Process player actions
         if (lastAction != ' ') {
-            if (static_cast<size_t>(selectedIndex) <= gameManager.getFoods().size()) {
-                FoodItem& food = gameManager.getFoods()[selectedIndex - 1];
-                if (unlocked[selectedIndex - 1]) {
-                    Delivery& delivery = gameManager.getDelivery()[selectedIndex - 1];
+            if (const FoodItem* food = gameManager.getFoods().get(selectedFood)) {
+                if (isUnlocked(selectedFood)) {
                     switch (lastAction) {
-                        case 's': gameManager.sell(food); break;
-                        case 'u': gameManager.upgrade(food); break;
-                        case 'd': gameManager.startDelivery(food, delivery, selectedIndex); break;
+                        case 's': gameManager.sell(selectedFood); break;
+                        case 'u': gameManager.upgrade(selectedFood); break;
+                        case 'd': gameManager.startDelivery(selectedFood); break;
                         default: ;
                     }
                     warningMessage.clear();
                 } else {
                     // Show warning if item is locked
-                    warningMessage = "Cannot sell or upgrade '" + food.getFoodName() +
-                                     "' (unlock cost: " + std::to_string(static_cast<int>(food.getUnlockCost())) + " RON)";
+                    warningMessage = "Cannot sell or upgrade '" + food->getFoodName() +
+                                     "' (unlock cost: " + std::to_string(static_cast<int>(food->getUnlockCost())) + " RON)";
                     warningClock.restart();
                 }
             }
             lastAction = ' ';
         }
 
+        telemetry.record(gameManager, player);
+
         // Check for newly unlocked items
-        for (size_t i = 0; i < unlocked.size(); ++i)
-            if (!unlocked[i] && player.getMoney() >= gameManager.getFoods()[i].getUnlockCost())
-                unlocked[i] = true;
+        const auto& foods = gameManager.getFoods();
+        for (size_t i = 0; i < foods.size(); ++i)
+            if (!isUnlocked(foods.handleAt(i)) && player.getMoney() >= foods[i].getUnlockCost())
+                unlocked.push_back(foods.handleAt(i));
 
         std::ostringstream buffer;
         buffer << "================ Luca Clicker =========================\n";
         buffer << "Controls: [S] Sell | [U] Upgrade | [D] Delivery | [Q] Quit\n";
+        buffer << "Telemetry: [E] Export | [G] Toggle graph\n";
         buffer << "Use [1-"<< static_cast<int>(gameManager.getFoods().size()) << "] to select a food item.\n";
         buffer << "======================================================\n";
         buffer << "Money: " << player.getMoney() << " RON\n";
-        buffer << "Currently selected item: " << selectedIndex << "\n\n";
+        const FoodItem* selected = foods.get(selectedFood);
+        buffer << "Currently selected item: " << (selected ? selected->getFoodName() : "none") << "\n\n";
 
         // Display food items and their status
-        for (size_t i = 0; i < gameManager.getFoods().size(); ++i) {
-            const auto& food = gameManager.getFoods()[i];
-            const auto& delivery = gameManager.getDelivery()[i];
-            if (unlocked[i])
+        for (size_t i = 0; i < foods.size(); ++i) {
+            const auto& food = foods[i];
+            const GameManager::FoodHandle handle = foods.handleAt(i);
+            const Delivery* delivery = gameManager.getDelivery().get(gameManager.courierFor(handle));
+            if (isUnlocked(handle))
                 buffer << "[" << i + 1 << "] " << food.getFoodName()
                        << " - Income: " << food.getBaseIncome()
                        << " | Upgrade: " << food.getUpgradeCost()
-                       << " | Delivery: " << delivery.getUnlockCost() << "\n";
+                       << " | Delivery: " << (delivery ? delivery->getUnlockCost() : 0.0) << "\n";
             else
                 buffer << "[" << i + 1 << "] (LOCKED - unlock at "
                        << food.getUnlockCost() << " RON)\n";
@@ -150,15 +169,70 @@ void Display::run() {
         window.draw(text);
         if (!warningMessage.empty())
             window.draw(warningText);
+        if (showGraph)
+            drawMoneySparkline();
         window.display();
 
         sf::sleep(sf::milliseconds(50)); // Control game loop
     }
 
     gameManager.stopAllDeliveries();
+    exportTelemetry();
     std::cout << "Exiting game...\n";
 }
 
+bool Display::isUnlocked(const GameManager::FoodHandle food) const {
+    return std::ranges::find(unlocked, food) != unlocked.end();
+}
+
+void Display::exportTelemetry() const {
+    // Same fallback as GameManager::saveGame when "resources" is not writable
+    const bool exported = (telemetry.exportCsv("resources/telemetry.csv") &&
+                           telemetry.exportBinary("resources/telemetry.bin")) ||
+                          (telemetry.exportCsv("telemetry.csv") && telemetry.exportBinary("telemetry.bin"));
+    if (exported)
+        std::cout << telemetry << " exported to telemetry.csv and telemetry.bin\n";
+    else
+        std::cerr << "Warning: Could not export telemetry\n";
+}
+
+void Display::drawMoneySparkline() {
+    constexpr std::size_t points = 120; // last 30 seconds at the default sampling interval
+    constexpr float width = 400.f, height = 120.f, margin = 40.f;
+
+    const std::vector<TelemetrySample> recent = telemetry.snapshot(points);
+    if (recent.size() < 2)
+        return;
+
+    const auto [low, high] = std::ranges::minmax(recent, {}, &TelemetrySample::money);
+    const double range = std::max(high.money - low.money, 1.0);
+    const sf::Vector2f origin(static_cast<float>(window.getSize().x) - width - margin, margin);
+
+    sf::RectangleShape frame({width, height});
+    frame.setPosition(origin);
+    frame.setFillColor(sf::Color(35, 35, 35));
+    frame.setOutlineColor(sf::Color(90, 90, 90));
+    frame.setOutlineThickness(1.f);
+
+    sf::VertexArray line(sf::PrimitiveType::LineStrip, recent.size());
+    for (std::size_t i = 0; i < recent.size(); ++i) {
+        const float x = width * static_cast<float>(i) / static_cast<float>(points - 1);
+        const float y = height * static_cast<float>(1.0 - (recent[i].money - low.money) / range);
+        line[i].position = {origin.x + x, origin.y + y};
+        line[i].color = sf::Color::Green;
+    }
+
+    sf::Text label(font, "Money: " + std::to_string(static_cast<long long>(low.money)) + " - " +
+                         std::to_string(static_cast<long long>(high.money)) + " RON");
+    label.setCharacterSize(20);
+    label.setFillColor(sf::Color::White);
+    label.setPosition({origin.x, origin.y + height + 5.f});
+
+    window.draw(frame);
+    window.draw(line);
+    window.draw(label);
+}
+
 
 
 
@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include "GameManager.h"
+#include "Telemetry.h"
 
 class Display {
 
@@ -13,12 +14,19 @@ class Display {
     GameManager& gameManager;
     Player& player;
 
-    std::vector<bool> unlocked;
+    std::vector<GameManager::FoodHandle> unlocked;
     char lastAction = ' ';
-    int selectedIndex = 1;
+    GameManager::FoodHandle selectedFood;
     std::string warningMessage;
     sf::Clock warningClock;
 
+    Telemetry telemetry;
+    bool showGraph = true;
+
+    [[nodiscard]] bool isUnlocked(GameManager::FoodHandle food) const;
+    void exportTelemetry() const;
+    void drawMoneySparkline();
+
 public:
     Display(GameManager& gm, Player& p);
     Display(const Display& other);
@@ -1,11 +1,12 @@
 #include "FoodItem.h"
 #include <iostream>
+#include <cmath>
 
 FoodItem::FoodItem(std::string  foodName_, const double baseIncome_, const double upgradeCost_, const double incomeMultiplier_, const double upgradeMultiplier_, const double unlockCost_)
-         :foodName(std::move(foodName_)), baseIncome(baseIncome_), upgradeCost(upgradeCost_), unlockCost(unlockCost_), incomeMultiplier(incomeMultiplier_), upgradeMultiplier(upgradeMultiplier_){}
+         :foodName(std::move(foodName_)), baseIncome(baseIncome_), upgradeCost(upgradeCost_), baseUpgradeCost(upgradeCost_), unlockCost(unlockCost_), incomeMultiplier(incomeMultiplier_), upgradeMultiplier(upgradeMultiplier_){}
 
 FoodItem::FoodItem(const FoodItem& foodItem)
-         :foodName(foodItem.foodName), baseIncome(foodItem.baseIncome), upgradeCost(foodItem.upgradeCost), unlockCost(foodItem.unlockCost), incomeMultiplier(foodItem.incomeMultiplier), upgradeMultiplier(foodItem.upgradeMultiplier){}
+         :foodName(foodItem.foodName), baseIncome(foodItem.baseIncome), upgradeCost(foodItem.upgradeCost), baseUpgradeCost(foodItem.baseUpgradeCost), unlockCost(foodItem.unlockCost), incomeMultiplier(foodItem.incomeMultiplier), upgradeMultiplier(foodItem.upgradeMultiplier){}
 
 FoodItem::~FoodItem(){std::cout<<"FoodItem-ul "<< foodName <<" a fost distrus!  \n";}
 
@@ -13,6 +14,7 @@ FoodItem &FoodItem::operator=(const FoodItem &foodItem) {
     foodName = foodItem.foodName;
     baseIncome = foodItem.baseIncome;
     upgradeCost = foodItem.upgradeCost;
+    baseUpgradeCost = foodItem.baseUpgradeCost;
     incomeMultiplier = foodItem.incomeMultiplier;
     upgradeMultiplier = foodItem.upgradeMultiplier;
     unlockCost = foodItem.unlockCost;
@@ -30,11 +32,20 @@ const std::string &FoodItem::getFoodName() const { return foodName; }
 double FoodItem::getBaseIncome() const { return baseIncome; }
 double FoodItem::getUpgradeCost() const { return upgradeCost; }
 double FoodItem::getUnlockCost() const { return unlockCost; }
+double FoodItem::getIncomeMultiplier() const { return incomeMultiplier; }
+double FoodItem::getUpgradeMultiplier() const { return upgradeMultiplier; }
 void FoodItem::setBaseIncome(const double newBaseIncome) { baseIncome = newBaseIncome; }
 void FoodItem::setUpgradeCost(const double newUpgradeCost) { upgradeCost = newUpgradeCost; }
 
 
 
+// Derived from the upgrade cost so it survives save files, which only store the current cost
+int FoodItem::getLevel() const {
+    if (upgradeMultiplier <= 0 || baseUpgradeCost <= 0 || upgradeCost <= baseUpgradeCost)
+        return 0;
+    return static_cast<int>(std::lround(std::log(upgradeCost / baseUpgradeCost) / std::log1p(upgradeMultiplier)));
+}
+
 double FoodItem::newIncome() const {
     return baseIncome * incomeMultiplier + baseIncome;
 }
@@ -7,6 +7,7 @@ class FoodItem {
     std::string foodName;
     double baseIncome;
     double upgradeCost;
+    double baseUpgradeCost;
     double unlockCost;
     double incomeMultiplier;
     double upgradeMultiplier;
@@ -23,6 +24,9 @@ public:
     [[nodiscard]] const std::string& getFoodName() const;
     [[nodiscard]] double getBaseIncome() const;
     [[nodiscard]] double getUpgradeCost() const;
+    [[nodiscard]] double getIncomeMultiplier() const;
+    [[nodiscard]] double getUpgradeMultiplier() const;
+    [[nodiscard]] int getLevel() const;
     [[nodiscard]] double newIncome() const;
     [[nodiscard]] double newUpgradeCost() const;
     void setBaseIncome(double newBaseIncome);
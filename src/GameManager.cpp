@@ -1,4 +1,5 @@
 #include "GameManager.h"
+#include "CompiledCatalog.h"
 #include <iostream>
 #include <thread>
 #include <fstream>
@@ -6,13 +7,22 @@
 #include <SFML/Graphics.hpp>
 
 GameManager::GameManager(Player& player_, std::vector<FoodItem> foodItem_, std::vector<Delivery> deliveries_)
-         : player(player_), foodItems(std::move(foodItem_)), deliveries(std::move(deliveries_)) {
-    deliveryRunning.resize(foodItems.size(), false);
+         : player(player_) {
+    // The i-th courier delivers the i-th food; the pairing is kept by handle so it survives erase/reorder
+    for (size_t i = 0; i < foodItem_.size(); ++i) {
+        const FoodHandle food = foodItems.insert(std::move(foodItem_[i]));
+        if (couriers.size() <= food.index)
+            couriers.resize(food.index + 1);
+        if (i < deliveries_.size())
+            couriers[food.index] = deliveries.insert(std::move(deliveries_[i]));
+    }
 }
 
 GameManager::GameManager(const GameManager& gameManager)
     : player(gameManager.player), foodItems(gameManager.foodItems), deliveries(gameManager.deliveries),
-      deliveryRunning(gameManager.deliveryRunning) {}
+      couriers(gameManager.couriers) {
+    restartRunningDeliveries();
+}
 
 GameManager::~GameManager(){
     stopAllDeliveries();
@@ -21,10 +31,13 @@ GameManager::~GameManager(){
 
 GameManager& GameManager::operator=(const GameManager& manager) {
     if (this != &manager) {
+        // Join our workers before their slot maps are replaced under them
+        stopAllDeliveries();
         player = manager.player;
         foodItems = manager.foodItems;
         deliveries = manager.deliveries;
-        deliveryRunning = manager.deliveryRunning;
+        couriers = manager.couriers;
+        restartRunningDeliveries();
     }
     return *this;
 }
@@ -38,19 +51,39 @@ std::ostream &operator<<(std::ostream &ostream, const GameManager &manager) {
     return ostream;
 }
 
-void GameManager::runDeliveryLoop(FoodItem &food, Delivery &delivery, int index) {
-    std::thread([this, &food, &delivery, index]() {
+// Workers are not copied with the manager; start our own for every courier the player has hired
+void GameManager::restartRunningDeliveries() {
+    for (size_t i = 0; i < foodItems.size(); ++i) {
+        const FoodHandle food = foodItems.handleAt(i);
+        const Delivery* courier = deliveries.get(courierFor(food));
+        if (courier && courier->isRunning())
+            runDeliveryLoop(food, courierFor(food));
+    }
+}
+
+void GameManager::runDeliveryLoop(const FoodHandle food, const DeliveryHandle delivery) {
+    const Delivery* courier = deliveries.get(delivery);
+    if (!courier)
+        return;
+
+    auto worker = std::make_unique<DeliveryWorker>();
+    worker->food = food;
+    DeliveryWorker& state = *worker; // heap-allocated, so the address stays valid for the thread
+    const float interval = courier->getTimeInterval().asSeconds();
+
+    worker->thread = std::thread([&state, interval]() {
         sf::Clock clock;
-        while (deliveryRunning[index]) {
-            // Add income at the determined interval
-            if (clock.getElapsedTime().asSeconds() >= delivery.getTimeInterval().asSeconds()) {
-                player.setMoney(player.getMoney() + food.getBaseIncome());
+        while (state.running) {
+            // Count a sale at the determined interval
+            if (clock.getElapsedTime().asSeconds() >= interval) {
+                ++state.pendingSales;
                 clock.restart();
             }
             using namespace std::chrono_literals;
             std::this_thread::sleep_for(50ms); // Prevent CPU overuse
         }
-    }).detach();
+    });
+    deliveryWorkers.push_back(std::move(worker));
 }
 
 GameManager GameManager::loadFromFile(const std::string &fileName, Player &player) {
@@ -133,50 +166,117 @@ GameManager GameManager::loadFromFile(const std::string &fileName, Player &playe
         deliveries.emplace_back(courierName, unlockDeliveryCost);
     }
 
-        // Display loaded items for verification
-        std::cout << "Loaded " << foodItems.size() << " food items and couriers:\n";
-        for (size_t i = 0; i < foodItems.size(); ++i) {
-            const auto& food = foodItems[i];
-            const auto& delivery = deliveries[i];
-
-            std::cout << "=======================================================\n";
-            std::cout << "Food Name: " << food.getFoodName() << "\n"
-                      << "  Base Income: " << food.getBaseIncome() << "\n"
-                      << "  Upgrade Cost: " << food.getUpgradeCost() << "\n"
-                      << "  Unlock Food Cost: " << food.getUnlockCost() << "\n"
-                      << "  Delivery Unlock Cost: " << delivery.getUnlockCost() << "\n"
-                      << "  Delivery Interval: " << delivery.getTimeInterval().asSeconds() << "s\n";
-        }
-             std::cout<< "=======================================================\n";
+    printCatalog(foodItems, deliveries);
 
     return { player, std::move(foodItems), std::move(deliveries) };
 }
 
-void GameManager::sell(const FoodItem &foodItem) const {
-    player.setMoney(player.getMoney() + foodItem.getBaseIncome());
+// Builds the catalog from the tables generated by cmake/CompileCatalog.cmake, so nothing is parsed at startup
+GameManager GameManager::loadCompiledCatalog(Player &player) {
+    std::vector<FoodItem> foodItems;
+    std::vector<Delivery> deliveries;
+    foodItems.reserve(COMPILED_CATALOG.size());
+    deliveries.reserve(COMPILED_CATALOG.size());
+
+    for (const auto& entry : COMPILED_CATALOG) {
+        foodItems.emplace_back(
+            std::string(entry.foodName),
+            entry.baseIncome,
+            entry.upgradeCost,
+            entry.incomeMultiplier,
+            entry.upgradeMultiplier,
+            entry.unlockFoodCost
+        );
+
+        deliveries.emplace_back(std::string(entry.courierName), entry.unlockDeliveryCost);
+    }
+
+    printCatalog(foodItems, deliveries);
+
+    return { player, std::move(foodItems), std::move(deliveries) };
 }
 
-void GameManager::upgrade(FoodItem &foodItem) const {
-    if (player.getMoney() >= foodItem.getUpgradeCost()) {
-        player.setMoney(player.getMoney() - foodItem.getUpgradeCost());
-        foodItem.update();
+void GameManager::printCatalog(const std::vector<FoodItem> &foodItems, const std::vector<Delivery> &deliveries) {
+    // Display loaded items for verification
+    std::cout << "Loaded " << foodItems.size() << " food items and couriers:\n";
+    for (size_t i = 0; i < foodItems.size(); ++i) {
+        const auto& food = foodItems[i];
+        const auto& delivery = deliveries[i];
+
+        std::cout << "=======================================================\n";
+        std::cout << "Food Name: " << food.getFoodName() << "\n"
+                  << "  Base Income: " << food.getBaseIncome() << "\n"
+                  << "  Upgrade Cost: " << food.getUpgradeCost() << "\n"
+                  << "  Unlock Food Cost: " << food.getUnlockCost() << "\n"
+                  << "  Delivery Unlock Cost: " << delivery.getUnlockCost() << "\n"
+                  << "  Delivery Interval: " << delivery.getTimeInterval().asSeconds() << "s\n";
     }
+    std::cout << "=======================================================\n";
 }
 
-void GameManager::startDelivery(FoodItem &foodItem, Delivery &delivery, const int index) {
-    if (!deliveryRunning[index-1] && delivery.canUnlock(player)) {
-        player.setMoney(player.getMoney() - delivery.getUnlockCost());
-        deliveryRunning[index-1] = true;
-        runDeliveryLoop(foodItem, delivery, index-1);
+void GameManager::sell(const FoodHandle food) const {
+    if (const FoodItem* foodItem = foodItems.get(food))
+        player.setMoney(player.getMoney() + foodItem->getBaseIncome());
+}
+
+void GameManager::upgrade(const FoodHandle food) {
+    FoodItem* foodItem = foodItems.get(food);
+    if (foodItem && player.getMoney() >= foodItem->getUpgradeCost()) {
+        player.setMoney(player.getMoney() - foodItem->getUpgradeCost());
+        foodItem->update();
+    }
+}
+
+void GameManager::startDelivery(const FoodHandle food) {
+    const DeliveryHandle delivery = courierFor(food);
+    Delivery* courier = deliveries.get(delivery);
+    if (courier && !courier->isRunning() && courier->canUnlock(player)) {
+        player.setMoney(player.getMoney() - courier->getUnlockCost());
+        courier->setRunning(true);
+        runDeliveryLoop(food, delivery);
     }
 }
 
 void GameManager::stopAllDeliveries() {
-    for (size_t i = 0; i < deliveryRunning.size(); ++i) {
-        deliveryRunning[i] = false;
+    for (auto& delivery : deliveries)
+        delivery.setRunning(false);
+    stopWorkers({});
+}
+
+// Joins the workers of one food, or of every food for an invalid handle, crediting their last sales
+void GameManager::stopWorkers(const FoodHandle food) {
+    const bool all = !foodItems.contains(food);
+    for (const auto& worker : deliveryWorkers) {
+        if (all || worker->food == food) {
+            worker->running = false;
+            if (worker->thread.joinable())
+                worker->thread.join();
+        }
+    }
+    collectDeliveries();
+    std::erase_if(deliveryWorkers, [&](const auto& worker) { return all || worker->food == food; });
+}
+
+// Called every UI tick: turns the sales counted by delivery threads into money on this thread
+void GameManager::collectDeliveries() {
+    for (const auto& worker : deliveryWorkers) {
+        const int sales = worker->pendingSales.exchange(0);
+        const FoodItem* foodItem = foodItems.get(worker->food);
+        if (sales > 0 && foodItem)
+            player.setMoney(player.getMoney() + sales * foodItem->getBaseIncome());
     }
 }
 
+// Stops the food's courier before erasing both, so no worker outlives its entity
+bool GameManager::removeFood(const FoodHandle food) {
+    if (!foodItems.contains(food))
+        return false;
+    stopWorkers(food);
+    (void)deliveries.erase(courierFor(food));
+    couriers[food.index] = {};
+    return foodItems.erase(food);
+}
+
 void GameManager::saveGame() const {
     std::ofstream file("resources/savegame.txt");
     if (!file.is_open()) {
@@ -194,7 +294,8 @@ void GameManager::saveGame() const {
         file << food.getFoodName() << "\n";
         file << food.getBaseIncome() << "\n";
         file << food.getUpgradeCost() << "\n";
-        file << deliveryRunning[i] << "\n";  // Save delivery state per food item
+        const Delivery* courier = deliveries.get(courierFor(foodItems.handleAt(i)));
+        file << (courier && courier->isRunning()) << "\n";  // Save delivery state per food item
     }
 
     file.close();
@@ -231,11 +332,13 @@ bool GameManager::loadSavedGame() {
 
             food.setBaseIncome(baseIncome);
             food.setUpgradeCost(upgradeCost);
-            deliveryRunning[i] = deliveryState;
 
             // Restart delivery if it was running
-            if (deliveryRunning[i]) {
-                runDeliveryLoop(food, deliveries[i], i);
+            const FoodHandle foodHandle = foodItems.handleAt(i);
+            if (Delivery* courier = deliveries.get(courierFor(foodHandle))) {
+                courier->setRunning(deliveryState);
+                if (deliveryState)
+                    runDeliveryLoop(foodHandle, courierFor(foodHandle));
             }
         }
 
@@ -247,10 +350,28 @@ bool GameManager::loadSavedGame() {
     }
 }
 
-std::vector<FoodItem> &GameManager::getFoods() {
+const SlotMap<FoodItem> &GameManager::getFoods() const {
     return foodItems;
 }
 
-std::vector<Delivery> &GameManager::getDelivery() {
+const SlotMap<Delivery> &GameManager::getDelivery() const {
     return deliveries;
 }
+
+// Invalid handle when the food is gone or has no courier
+GameManager::DeliveryHandle GameManager::courierFor(const FoodHandle food) const {
+    if (!foodItems.contains(food) || food.index >= couriers.size())
+        return {};
+    return couriers[food.index];
+}
+
+// Passive income from running couriers, in RON per second
+double GameManager::incomeRate() const {
+    double rate = 0;
+    for (size_t i = 0; i < foodItems.size(); ++i) {
+        const Delivery* courier = deliveries.get(courierFor(foodItems.handleAt(i)));
+        if (courier && courier->isRunning())
+            rate += foodItems[i].getBaseIncome() / courier->getTimeInterval().asSeconds();
+    }
+    return rate;
+}
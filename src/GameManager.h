@@ -1,19 +1,41 @@
 #ifndef OOP_GAMEMANAGER_H
 #define OOP_GAMEMANAGER_H
 
+#include <atomic>
+#include <memory>
 #include <vector>
+#include <thread>
 #include "Player.h"
 #include "FoodItem.h"
 #include "Delivery.h"
+#include "SlotMap.h"
 #include <SFML/Graphics.hpp>
 
 class GameManager {
+public:
+    using FoodHandle = SlotMap<FoodItem>::Handle;
+    using DeliveryHandle = SlotMap<Delivery>::Handle;
+
+private:
     Player& player;
-    std::vector<FoodItem> foodItems;
-    std::vector<Delivery> deliveries;
-    std::vector<bool> deliveryRunning;
+    SlotMap<FoodItem> foodItems;
+    SlotMap<Delivery> deliveries;
+    std::vector<DeliveryHandle> couriers; // food slot index -> courier of that food
+
+    // State shared with one delivery thread. The thread touches nothing else: it only counts
+    // sales, and collectDeliveries turns them into money on the UI thread.
+    struct DeliveryWorker {
+        FoodHandle food;
+        std::atomic<bool> running = true;
+        std::atomic<int> pendingSales = 0;
+        std::thread thread;
+    };
+    std::vector<std::unique_ptr<DeliveryWorker>> deliveryWorkers; // joined by stopAllDeliveries, never outlive the manager
 
-    void runDeliveryLoop(FoodItem& food, Delivery& delivery, int index);
+    void runDeliveryLoop(FoodHandle food, DeliveryHandle delivery);
+    void stopWorkers(FoodHandle food);
+    void restartRunningDeliveries();
+    static void printCatalog(const std::vector<FoodItem>& foodItems, const std::vector<Delivery>& deliveries);
 
 public:
     GameManager(Player& player_, std::vector<FoodItem> foodItem_, std::vector<Delivery> deliveries_);
@@ -23,12 +45,17 @@ public:
     friend std::ostream& operator<<(std::ostream& ostream, const GameManager& manager);
 
     static GameManager loadFromFile(const std::string& fileName, Player& player);
-    void sell(const FoodItem& foodItem) const;
-    void upgrade(FoodItem& foodItem) const;
-    void startDelivery(FoodItem& foodItem, Delivery& delivery, int index);
+    static GameManager loadCompiledCatalog(Player& player);
+    void sell(FoodHandle food) const;
+    void upgrade(FoodHandle food);
+    void startDelivery(FoodHandle food);
     void stopAllDeliveries();
-    std::vector<FoodItem>& getFoods();
-    std::vector<Delivery>& getDelivery();
+    void collectDeliveries();
+    bool removeFood(FoodHandle food);
+    [[nodiscard]] const SlotMap<FoodItem>& getFoods() const;
+    [[nodiscard]] const SlotMap<Delivery>& getDelivery() const;
+    [[nodiscard]] DeliveryHandle courierFor(FoodHandle food) const;
+    [[nodiscard]] double incomeRate() const;
     void saveGame() const;
     bool loadSavedGame();
 };
@@ -0,0 +1,109 @@
+#ifndef OOP_SLOTMAP_H
+#define OOP_SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Slot map: values live densely in a vector (fast iteration), while callers keep
+// generational handles instead of references. A handle stays valid across vector
+// reallocation and container copies; once its value is erased the slot's
+// generation is bumped, so stale handles resolve to nullptr instead of dangling.
+// Not safe to mutate concurrently: insert/erase must not race with get() on another thread.
+template <typename T>
+class SlotMap {
+public:
+    struct Handle {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0; // 0 is never a live generation, so a default handle is invalid
+
+        friend bool operator==(const Handle&, const Handle&) = default;
+    };
+
+private:
+    struct Slot {
+        std::uint32_t denseIndex = 0;
+        std::uint32_t generation = 1;
+    };
+
+    std::vector<T> values;                 // dense storage
+    std::vector<std::uint32_t> valueSlots; // dense index -> slot index
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> freeSlots;
+
+public:
+    Handle insert(T value) {
+        std::uint32_t slotIndex;
+        if (!freeSlots.empty()) {
+            slotIndex = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slotIndex = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+
+        Slot& slot = slots[slotIndex];
+        slot.denseIndex = static_cast<std::uint32_t>(values.size());
+        values.push_back(std::move(value));
+        valueSlots.push_back(slotIndex);
+        return { slotIndex, slot.generation };
+    }
+
+    bool erase(const Handle handle) {
+        if (!contains(handle))
+            return false;
+
+        Slot& slot = slots[handle.index];
+        const std::uint32_t removed = slot.denseIndex;
+        const std::uint32_t last = static_cast<std::uint32_t>(values.size() - 1);
+
+        // Swap-and-pop keeps the dense array packed
+        if (removed != last) {
+            values[removed] = std::move(values[last]);
+            valueSlots[removed] = valueSlots[last];
+            slots[valueSlots[removed]].denseIndex = removed;
+        }
+        values.pop_back();
+        valueSlots.pop_back();
+
+        ++slot.generation;
+        if (slot.generation == 0) // skip the reserved invalid generation on wrap-around
+            slot.generation = 1;
+        freeSlots.push_back(handle.index);
+        return true;
+    }
+
+    [[nodiscard]] bool contains(const Handle handle) const {
+        return handle.index < slots.size() && handle.generation != 0 &&
+               slots[handle.index].generation == handle.generation;
+    }
+
+    [[nodiscard]] T* get(const Handle handle) {
+        return contains(handle) ? &values[slots[handle.index].denseIndex] : nullptr;
+    }
+
+    [[nodiscard]] const T* get(const Handle handle) const {
+        return contains(handle) ? &values[slots[handle.index].denseIndex] : nullptr;
+    }
+
+    // Handle of the value stored at a position of the dense array
+    [[nodiscard]] Handle handleAt(const std::size_t denseIndex) const {
+        const std::uint32_t slotIndex = valueSlots[denseIndex];
+        return { slotIndex, slots[slotIndex].generation };
+    }
+
+    [[nodiscard]] std::size_t size() const { return values.size(); }
+    [[nodiscard]] bool empty() const { return values.empty(); }
+
+    T& operator[](const std::size_t denseIndex) { return values[denseIndex]; }
+    const T& operator[](const std::size_t denseIndex) const { return values[denseIndex]; }
+
+    auto begin() { return values.begin(); }
+    auto end() { return values.end(); }
+    auto begin() const { return values.begin(); }
+    auto end() const { return values.end(); }
+};
+
+
+#endif //OOP_SLOTMAP_H
@@ -0,0 +1,126 @@
+#include "Telemetry.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+Telemetry::Telemetry(const sf::Time interval_) : samples(CAPACITY), interval(interval_) {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+}
+
+Telemetry::~Telemetry() { std::cout << "Telemetry a fost distrus! \n"; }
+
+std::ostream &operator<<(std::ostream &os, const Telemetry &telemetry) {
+    os << "Telemetry: " << std::min<std::uint64_t>(telemetry.written, Telemetry::CAPACITY)
+       << " samples every " << telemetry.interval.asSeconds() << "s";
+    return os;
+}
+
+// Called every frame; only the clock read is paid until the next sample is due
+void Telemetry::record(const GameManager &gameManager, const Player &player) {
+    const sf::Time now = sessionClock.getElapsedTime();
+    if (now < nextSample)
+        return;
+    nextSample = now + interval;
+
+    const auto& foods = gameManager.getFoods();
+    const auto& deliveries = gameManager.getDelivery();
+    const std::size_t itemCount = std::min(foods.size(), TelemetrySample::MAX_ITEMS);
+    if (itemNames.size() != itemCount) {
+        itemNames.clear();
+        for (std::size_t i = 0; i < itemCount; ++i)
+            itemNames.push_back(foods[i].getFoodName());
+    }
+
+    const std::uint64_t index = written;
+    TelemetrySample& sample = samples[index & (CAPACITY - 1)];
+    sample.seconds = now.asSeconds();
+    sample.money = player.getMoney();
+    sample.incomeRate = gameManager.incomeRate();
+    sample.itemCount = static_cast<std::uint8_t>(itemCount);
+    sample.courierMask = 0;
+    for (std::size_t i = 0; i < itemCount; ++i) {
+        sample.levels[i] = static_cast<std::uint16_t>(std::clamp(foods[i].getLevel(), 0, 0xFFFF));
+        const Delivery* courier = deliveries.get(gameManager.courierFor(foods.handleAt(i)));
+        if (courier && courier->isRunning())
+            sample.courierMask |= static_cast<std::uint16_t>(1u << i);
+    }
+    written = index + 1;
+}
+
+// Oldest to newest, at most maxCount of the most recent samples
+std::vector<TelemetrySample> Telemetry::snapshot(const std::size_t maxCount) const {
+    const std::uint64_t end = written;
+    const std::uint64_t count = std::min<std::uint64_t>({end, CAPACITY, maxCount});
+
+    std::vector<TelemetrySample> result;
+    result.reserve(count);
+    for (std::uint64_t i = end - count; i < end; ++i)
+        result.push_back(samples[i & (CAPACITY - 1)]);
+    return result;
+}
+
+bool Telemetry::exportCsv(const std::string &fileName) const {
+    std::ofstream file(fileName);
+    if (!file.is_open())
+        return false;
+
+    // Item names may contain commas or quotes, so header fields are quoted (RFC 4180)
+    const auto quoted = [](const std::string& field) {
+        std::string result = "\"";
+        for (const char c : field) {
+            if (c == '"')
+                result += '"';
+            result += c;
+        }
+        return result + "\"";
+    };
+
+    file << "seconds,money,incomeRate";
+    for (const auto& name : itemNames)
+        file << "," << quoted(name + "_level");
+    for (const auto& name : itemNames)
+        file << "," << quoted(name + "_courier");
+    file << "\n";
+
+    // Enough digits to round-trip, so large balances are not cut to 6 significant digits
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    for (const auto& sample : snapshot()) {
+        file << sample.seconds << "," << sample.money << "," << sample.incomeRate;
+        for (std::size_t i = 0; i < itemNames.size(); ++i)
+            file << "," << (i < sample.itemCount ? sample.levels[i] : 0);
+        for (std::size_t i = 0; i < itemNames.size(); ++i)
+            file << "," << ((sample.courierMask >> i) & 1u);
+        file << "\n";
+    }
+    return file.good();
+}
+
+// Layout (native byte order): "LCTM", u32 version, u64 sample count, then per sample
+// f32 seconds, f64 money, f64 incomeRate, u8 itemCount, u16 courierMask, u16 level[itemCount]
+bool Telemetry::exportBinary(const std::string &fileName) const {
+    std::ofstream file(fileName, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    const auto put = [&file](const auto& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    const std::vector<TelemetrySample> recorded = snapshot();
+    file.write("LCTM", 4);
+    put(std::uint32_t{1});
+    put(static_cast<std::uint64_t>(recorded.size()));
+    for (const auto& sample : recorded) {
+        put(sample.seconds);
+        put(sample.money);
+        put(sample.incomeRate);
+        put(sample.itemCount);
+        put(sample.courierMask);
+        for (std::size_t i = 0; i < sample.itemCount; ++i)
+            put(sample.levels[i]);
+    }
+    return file.good();
+}
@@ -0,0 +1,54 @@
+#ifndef OOP_TELEMETRY_H
+#define OOP_TELEMETRY_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <SFML/System/Clock.hpp>
+#include "CompiledCatalog.h"
+#include "GameManager.h"
+
+struct TelemetrySample {
+    static constexpr std::size_t MAX_ITEMS = MAX_CATALOG_ITEMS;
+    static_assert(MAX_ITEMS <= 16, "courierMask has one bit per item");
+
+    float seconds = 0;
+    double money = 0;
+    double incomeRate = 0;
+    std::uint8_t itemCount = 0;
+    std::uint16_t courierMask = 0; // bit i set while courier i is running
+    std::array<std::uint16_t, MAX_ITEMS> levels{};
+};
+
+// Fixed-size ring of economy samples. Recording never allocates or locks: it fills
+// the next slot and bumps a counter, and the oldest samples are overwritten once the
+// ring is full. The ring is single-threaded: record, snapshot and the exporters must
+// all run on the thread that owns it (the Display loop).
+class Telemetry {
+public:
+    static constexpr std::size_t CAPACITY = 4096; // power of two, ~17 minutes at the default interval
+
+private:
+    std::vector<TelemetrySample> samples;
+    std::uint64_t written = 0;
+    std::vector<std::string> itemNames;
+    sf::Clock sessionClock;
+    sf::Time interval;
+    sf::Time nextSample;
+
+public:
+    explicit Telemetry(sf::Time interval_ = sf::milliseconds(250));
+    Telemetry(const Telemetry&) = delete;
+    Telemetry& operator=(const Telemetry&) = delete;
+    ~Telemetry();
+    friend std::ostream& operator<<(std::ostream& os, const Telemetry& telemetry);
+
+    void record(const GameManager& gameManager, const Player& player);
+    [[nodiscard]] std::vector<TelemetrySample> snapshot(std::size_t maxCount = CAPACITY) const;
+    [[nodiscard]] bool exportCsv(const std::string& fileName) const;
+    [[nodiscard]] bool exportBinary(const std::string& fileName) const;
+};
+
+
+#endif //OOP_TELEMETRY_H
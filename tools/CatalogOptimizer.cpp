@@ -0,0 +1,505 @@
+// Offline balancing tool: loads a catalog through GameManager::loadFromFile and runs
+// thousands of simulated playthroughs per purchase policy on all cores, then reports
+// time-to-milestone distributions, the best policy, dominant policies and pacing cliffs.
+//
+// Usage: catalog_optimizer [catalog=resources/textfile.txt] [runs=2000] [horizonSeconds=7200] [seed=1]
+// The default catalog path is relative to the working directory; the build copies resources/
+// next to the binary, so run it from the build output directory or pass the path explicitly.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/Player.h"
+#include "../src/GameManager.h"
+
+namespace {
+
+constexpr double NOT_REACHED = std::numeric_limits<double>::infinity();
+
+// Plain copy of one catalog entry, so simulations never copy the chatty game objects
+struct CatalogEntry {
+    std::string foodName;
+    double baseIncome;
+    double upgradeCost;
+    double incomeMultiplier;
+    double upgradeMultiplier;
+    double unlockCost;
+    std::string courierName;
+    double courierCost;
+    double courierInterval;
+};
+
+enum class Priority { UpgradeFirst, CourierFirst, BestReturn, Random };
+enum class Target { Cheapest, BestRatio };
+
+struct Strategy {
+    Priority priority;
+    Target target;
+    bool rushUnlocks; // buy nothing while an item is still locked
+
+    [[nodiscard]] std::string name() const {
+        std::string result;
+        switch (priority) {
+            case Priority::UpgradeFirst: result = "upgrade-first"; break;
+            case Priority::CourierFirst: result = "courier-first"; break;
+            case Priority::BestReturn: result = "best-return"; break;
+            case Priority::Random: return "random";
+        }
+        result += target == Target::Cheapest ? "/cheapest" : "/best-ratio";
+        if (rushUnlocks)
+            result += "/rush-unlocks";
+        return result;
+    }
+};
+
+struct SimConfig {
+    double horizon = 7200.0;
+    double minClicksPerSecond = 3.0;
+    double maxClicksPerSecond = 8.0;
+    double minThinkSeconds = 0.5;
+    double maxThinkSeconds = 2.0;
+};
+
+// Milestone layout: [0, n-1) unlock item i+1, [n-1, 2n-1) hire courier i,
+// then the money-earned thresholds, and "catalog complete" last
+struct MilestoneLayout {
+    std::size_t itemCount;
+    std::vector<double> earnedThresholds{1e3, 1e4, 1e5, 1e6};
+
+    [[nodiscard]] std::size_t unlock(const std::size_t item) const { return item - 1; }
+    [[nodiscard]] std::size_t courier(const std::size_t item) const { return itemCount - 1 + item; }
+    [[nodiscard]] std::size_t earned(const std::size_t k) const { return 2 * itemCount - 1 + k; }
+    [[nodiscard]] std::size_t complete() const { return 2 * itemCount - 1 + earnedThresholds.size(); }
+    [[nodiscard]] std::size_t count() const { return complete() + 1; }
+    // Unlocks, couriers and completion come from the catalog; the earned thresholds are synthetic
+    [[nodiscard]] bool fromCatalog(const std::size_t milestone) const {
+        return milestone < earned(0) || milestone == complete();
+    }
+
+    [[nodiscard]] std::string name(const std::size_t milestone, const std::vector<CatalogEntry>& catalog) const {
+        if (milestone == complete())
+            return "catalog complete";
+        if (milestone >= earned(0))
+            return "earned " + std::to_string(static_cast<long long>(earnedThresholds[milestone - earned(0)])) + " RON";
+        if (milestone >= courier(0))
+            return "courier " + catalog[milestone - courier(0)].courierName;
+        return "unlock " + catalog[milestone + 1].foodName;
+    }
+};
+
+struct ItemState {
+    double income;
+    double upgradeCost;
+    bool unlocked = false;
+    bool courier = false;
+};
+
+struct Purchase {
+    std::size_t item;
+    bool isCourier;
+    double cost;
+    double gain; // extra RON per second
+};
+
+class Playthrough {
+    const std::vector<CatalogEntry>& catalog;
+    const MilestoneLayout& layout;
+    const Strategy strategy;
+    const SimConfig& config;
+    std::mt19937_64 rng;
+
+    std::vector<ItemState> items;
+    double money = 0.0;
+    double earned = 0.0;
+    double time = 0.0;
+    double clicksPerSecond;
+    std::size_t clickedItem = 0;
+    double* milestones; // this run's row of the shared result table
+
+    void reach(const std::size_t milestone) {
+        if (milestones[milestone] == NOT_REACHED)
+            milestones[milestone] = time;
+    }
+
+    [[nodiscard]] double incomeRate() const {
+        double rate = clicksPerSecond * items[clickedItem].income;
+        for (std::size_t i = 0; i < items.size(); ++i)
+            if (items[i].courier)
+                rate += items[i].income / catalog[i].courierInterval;
+        return rate;
+    }
+
+    void selectClickedItem() {
+        for (std::size_t i = 0; i < items.size(); ++i)
+            if (items[i].unlocked && items[i].income > items[clickedItem].income)
+                clickedItem = i;
+    }
+
+    [[nodiscard]] bool anyLocked() const {
+        return std::ranges::any_of(items, [](const ItemState& item) { return !item.unlocked; });
+    }
+
+    void checkComplete() {
+        if (std::ranges::all_of(items, [](const ItemState& item) { return item.unlocked && item.courier; }))
+            reach(layout.complete());
+    }
+
+    [[nodiscard]] std::vector<Purchase> candidates(const bool couriers) const {
+        std::vector<Purchase> result;
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            const ItemState& item = items[i];
+            if (!item.unlocked)
+                continue;
+            if (couriers) {
+                if (!item.courier)
+                    result.push_back({i, true, catalog[i].courierCost, item.income / catalog[i].courierInterval});
+            } else {
+                // Same formula as FoodItem::newIncome
+                const double delta = item.income * catalog[i].incomeMultiplier;
+                double gain = item.courier ? delta / catalog[i].courierInterval : 0.0;
+                if (i == clickedItem)
+                    gain += delta * clicksPerSecond;
+                result.push_back({i, false, item.upgradeCost, gain});
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] const Purchase* pick(const std::vector<Purchase>& options) const {
+        const auto better = [this](const Purchase& a, const Purchase& b) {
+            if (strategy.target == Target::Cheapest)
+                return a.cost < b.cost;
+            return a.gain * b.cost > b.gain * a.cost;
+        };
+        const Purchase* best = nullptr;
+        for (const auto& option : options)
+            if (!best || better(option, *best))
+                best = &option;
+        return best;
+    }
+
+    // Returns the purchase the policy wants now, or nothing to keep saving
+    [[nodiscard]] std::optional<Purchase> choose() {
+        if (strategy.rushUnlocks && anyLocked())
+            return std::nullopt;
+
+        const auto affordable = [this](const Purchase* purchase) {
+            return purchase && purchase->cost <= money;
+        };
+
+        switch (strategy.priority) {
+            case Priority::Random: {
+                std::vector<Purchase> options = candidates(false);
+                const std::vector<Purchase> couriers = candidates(true);
+                options.insert(options.end(), couriers.begin(), couriers.end());
+                std::erase_if(options, [this](const Purchase& p) { return p.cost > money; });
+                if (options.empty())
+                    return std::nullopt;
+                std::uniform_int_distribution<std::size_t> index(0, options.size() - 1);
+                return options[index(rng)];
+            }
+            case Priority::BestReturn: {
+                std::vector<Purchase> options = candidates(false);
+                const std::vector<Purchase> couriers = candidates(true);
+                options.insert(options.end(), couriers.begin(), couriers.end());
+                const Purchase* best = pick(options);
+                if (affordable(best))
+                    return *best;
+                return std::nullopt;
+            }
+            case Priority::UpgradeFirst:
+            case Priority::CourierFirst: {
+                // Prefer one kind; fall back to the other only when the preferred target is out of reach
+                const bool couriersFirst = strategy.priority == Priority::CourierFirst;
+                const std::vector<Purchase> preferred = candidates(couriersFirst);
+                if (const Purchase* best = pick(preferred); affordable(best))
+                    return *best;
+                const std::vector<Purchase> fallback = candidates(!couriersFirst);
+                if (const Purchase* best = pick(fallback); affordable(best))
+                    return *best;
+                return std::nullopt;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void buy(const Purchase& purchase) {
+        money -= purchase.cost;
+        ItemState& item = items[purchase.item];
+        if (purchase.isCourier) {
+            item.courier = true;
+            reach(layout.courier(purchase.item));
+            checkComplete();
+        } else {
+            // Same formulas as FoodItem::update
+            item.upgradeCost += catalog[purchase.item].upgradeMultiplier * item.upgradeCost;
+            item.income += catalog[purchase.item].incomeMultiplier * item.income;
+        }
+    }
+
+    // Money only grows between decisions, so threshold crossings are solved in closed form
+    void advance(const double duration) {
+        const double rate = incomeRate();
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            if (items[i].unlocked || money + rate * duration < catalog[i].unlockCost)
+                continue;
+            items[i].unlocked = true;
+            const double crossing = rate > 0.0 ? std::max(0.0, (catalog[i].unlockCost - money) / rate) : 0.0;
+            if (i > 0 && milestones[layout.unlock(i)] == NOT_REACHED)
+                milestones[layout.unlock(i)] = time + crossing;
+        }
+        for (std::size_t k = 0; k < layout.earnedThresholds.size(); ++k) {
+            const double threshold = layout.earnedThresholds[k];
+            if (milestones[layout.earned(k)] == NOT_REACHED && earned + rate * duration >= threshold)
+                milestones[layout.earned(k)] = time + std::max(0.0, (threshold - earned) / rate);
+        }
+        money += rate * duration;
+        earned += rate * duration;
+        time += duration;
+        checkComplete();
+    }
+
+public:
+    Playthrough(const std::vector<CatalogEntry>& catalog_, const MilestoneLayout& layout_, const Strategy strategy_,
+                const SimConfig& config_, std::seed_seq& seed, double* milestones_)
+        : catalog(catalog_), layout(layout_), strategy(strategy_), config(config_), rng(seed), milestones(milestones_) {
+        std::uniform_real_distribution<double> clicks(config.minClicksPerSecond, config.maxClicksPerSecond);
+        clicksPerSecond = clicks(rng);
+
+        for (const auto& entry : catalog)
+            items.push_back({entry.baseIncome, entry.upgradeCost});
+        items[0].unlocked = true; // First item starts unlocked, as in Display
+        std::fill(milestones, milestones + layout.count(), NOT_REACHED);
+    }
+
+    [[nodiscard]] bool allReached() const {
+        return std::all_of(milestones, milestones + layout.count(), [](const double t) { return t != NOT_REACHED; });
+    }
+
+    void run() {
+        std::uniform_real_distribution<double> think(config.minThinkSeconds, config.maxThinkSeconds);
+        advance(0.0);
+
+        while (time < config.horizon && !allReached()) {
+            selectClickedItem();
+            // A player can make several purchases per decision; the cap guards against zero-cost loops
+            for (int purchases = 0; purchases < 64; ++purchases) {
+                const auto purchase = choose();
+                if (!purchase)
+                    break;
+                buy(*purchase);
+            }
+            advance(std::min(think(rng), config.horizon - time));
+        }
+    }
+};
+
+std::vector<CatalogEntry> loadCatalog(const std::string& fileName) {
+    Player player("Optimizer", 0.0);
+    GameManager manager = GameManager::loadFromFile(fileName, player);
+
+    std::vector<CatalogEntry> catalog;
+    const auto& foods = manager.getFoods();
+    const auto& deliveries = manager.getDelivery();
+    for (std::size_t i = 0; i < foods.size(); ++i) {
+        const FoodItem& food = foods[i];
+        const Delivery* delivery = deliveries.get(manager.courierFor(foods.handleAt(i)));
+        if (!delivery)
+            throw std::runtime_error("Error: food item " + food.getFoodName() + " has no courier");
+        catalog.push_back({food.getFoodName(), food.getBaseIncome(), food.getUpgradeCost(),
+                           food.getIncomeMultiplier(), food.getUpgradeMultiplier(), food.getUnlockCost(),
+                           delivery->getName(), delivery->getUnlockCost(),
+                           delivery->getTimeInterval().asSeconds()});
+    }
+    if (catalog.empty())
+        throw std::runtime_error("Error: catalog " + fileName + " has no food items");
+    return catalog;
+}
+
+std::vector<Strategy> allStrategies() {
+    std::vector<Strategy> strategies;
+    for (const Priority priority : {Priority::UpgradeFirst, Priority::CourierFirst, Priority::BestReturn})
+        for (const Target target : {Target::Cheapest, Target::BestRatio})
+            for (const bool rush : {false, true})
+                strategies.push_back({priority, target, rush});
+    strategies.push_back({Priority::Random, Target::Cheapest, false});
+    return strategies;
+}
+
+// Value at the given fraction of the sorted samples; unreached milestones sort last as +inf
+double quantile(const std::vector<double>& sorted, const double fraction) {
+    const auto index = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+std::string formatTime(const double seconds) {
+    if (seconds == NOT_REACHED)
+        return "never";
+    std::ostringstream out;
+    const auto total = static_cast<long long>(seconds + 0.5);
+    out << total / 60 << "m" << std::setw(2) << std::setfill('0') << total % 60 << "s";
+    return out.str();
+}
+
+struct Summary {
+    double p10, p50, p90, reachedShare;
+};
+
+Summary summarize(std::vector<double> samples) {
+    std::ranges::sort(samples);
+    const auto reached = std::ranges::count_if(samples, [](const double t) { return t != NOT_REACHED; });
+    return {quantile(samples, 0.1), quantile(samples, 0.5), quantile(samples, 0.9),
+            static_cast<double>(reached) / static_cast<double>(samples.size())};
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        const std::string catalogFile = argc > 1 ? argv[1] : "resources/textfile.txt";
+        // Parsed signed, since stoul would wrap "-5" around to a huge run count
+        const long long runCount = argc > 2 ? std::stoll(argv[2]) : 2000;
+        SimConfig config;
+        if (argc > 3)
+            config.horizon = std::stod(argv[3]);
+        const std::uint64_t seed = argc > 4 ? std::stoull(argv[4]) : 1;
+        if (runCount <= 0 || config.horizon <= 0.0)
+            throw std::invalid_argument("runs and horizon must be positive");
+        const auto runs = static_cast<std::size_t>(runCount);
+
+        const std::vector<CatalogEntry> catalog = loadCatalog(catalogFile);
+        const MilestoneLayout layout{catalog.size()};
+        const std::vector<Strategy> strategies = allStrategies();
+
+        // One row of milestone times per (strategy, run); each job owns its row, so no locking
+        const std::size_t jobs = strategies.size() * runs;
+        std::vector<double> results(jobs * layout.count(), NOT_REACHED);
+        std::atomic<std::size_t> nextJob{0};
+
+        const unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threadCount; ++t) {
+            workers.emplace_back([&]() {
+                for (std::size_t job = nextJob++; job < jobs; job = nextJob++) {
+                    const std::size_t strategyIndex = job / runs;
+                    // Seeded per job, not per thread, so results do not depend on the core count
+                    // seed_seq keeps only 32 bits per value, so the 64-bit seed goes in as two halves
+                    std::seed_seq runSeed{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                                          static_cast<std::uint32_t>(strategyIndex), static_cast<std::uint32_t>(job % runs)};
+                    Playthrough(catalog, layout, strategies[strategyIndex], config, runSeed,
+                                &results[job * layout.count()]).run();
+                }
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+
+        // summaries[strategy][milestone]
+        std::vector<std::vector<Summary>> summaries(strategies.size());
+        for (std::size_t s = 0; s < strategies.size(); ++s) {
+            for (std::size_t m = 0; m < layout.count(); ++m) {
+                std::vector<double> samples(runs);
+                for (std::size_t r = 0; r < runs; ++r)
+                    samples[r] = results[(s * runs + r) * layout.count() + m];
+                summaries[s].push_back(summarize(std::move(samples)));
+            }
+        }
+
+        std::cout << "\n================ Catalog optimizer =====================\n";
+        std::cout << catalog.size() << " items, " << strategies.size() << " strategies x " << runs << " runs, "
+                  << threadCount << " threads, horizon " << formatTime(config.horizon) << "\n\n";
+
+        std::cout << std::left << std::setw(42) << "Strategy" << std::right << std::setw(10) << "complete"
+                  << std::setw(10) << "p10" << std::setw(10) << "p50" << std::setw(10) << "p90" << "\n";
+        std::size_t best = 0;
+        for (std::size_t s = 0; s < strategies.size(); ++s) {
+            const Summary& done = summaries[s][layout.complete()];
+            std::cout << std::left << std::setw(42) << strategies[s].name() << std::right << std::setw(9)
+                      << std::fixed << std::setprecision(1) << done.reachedShare * 100.0 << "%" << std::setw(10)
+                      << formatTime(done.p10) << std::setw(10) << formatTime(done.p50) << std::setw(10)
+                      << formatTime(done.p90) << "\n";
+
+            const Summary& bestDone = summaries[best][layout.complete()];
+            if (done.reachedShare > bestDone.reachedShare ||
+                (done.reachedShare == bestDone.reachedShare && done.p50 < bestDone.p50))
+                best = s;
+        }
+
+        std::cout << "\nBest strategy: " << strategies[best].name() << "\n";
+        std::cout << std::left << std::setw(42) << "Milestone" << std::right << std::setw(10) << "reached"
+                  << std::setw(10) << "p10" << std::setw(10) << "p50" << std::setw(10) << "p90" << "\n";
+
+        // Milestones in the order the best strategy reaches them, to spot pacing cliffs between catalog milestones
+        std::vector<std::size_t> order(layout.count());
+        for (std::size_t m = 0; m < order.size(); ++m)
+            order[m] = m;
+        std::ranges::stable_sort(order, {}, [&](const std::size_t m) { return summaries[best][m].p50; });
+
+        double previousTime = 0.0, previousGap = 0.0;
+        std::vector<std::string> cliffs;
+        for (const std::size_t m : order) {
+            const Summary& summary = summaries[best][m];
+            std::cout << std::left << std::setw(42) << layout.name(m, catalog) << std::right << std::setw(9)
+                      << summary.reachedShare * 100.0 << "%" << std::setw(10) << formatTime(summary.p10)
+                      << std::setw(10) << formatTime(summary.p50) << std::setw(10) << formatTime(summary.p90) << "\n";
+
+            // The decade-spaced money thresholds would always look like cliffs, so only catalog milestones count
+            if (summary.p50 == NOT_REACHED || !layout.fromCatalog(m))
+                continue;
+            // A wait much longer than the previous one (and longer than a minute) is a pacing cliff
+            const double gap = summary.p50 - previousTime;
+            if (previousGap > 0.0 && gap > 3.0 * previousGap && gap > 60.0)
+                cliffs.push_back(layout.name(m, catalog) + " (" + formatTime(gap) + " after the previous milestone)");
+            if (gap > 0.0)
+                previousGap = gap;
+            previousTime = summary.p50;
+        }
+
+        // A strategy is dominant when it alone has the fastest median on every milestone anyone reaches;
+        // milestones nobody reaches are skipped and ties award no win
+        std::vector<std::size_t> wins(strategies.size(), 0);
+        std::size_t contested = 0;
+        for (std::size_t m = 0; m < layout.count(); ++m) {
+            std::size_t fastest = 0;
+            bool tied = false;
+            for (std::size_t s = 1; s < strategies.size(); ++s) {
+                if (summaries[s][m].p50 < summaries[fastest][m].p50) {
+                    fastest = s;
+                    tied = false;
+                } else if (summaries[s][m].p50 == summaries[fastest][m].p50) {
+                    tied = true;
+                }
+            }
+            if (summaries[fastest][m].p50 == NOT_REACHED)
+                continue;
+            ++contested;
+            if (!tied)
+                ++wins[fastest];
+        }
+        std::cout << "\n";
+        for (std::size_t s = 0; s < strategies.size(); ++s)
+            if (contested > 0 && wins[s] == contested)
+                std::cout << "Dominant strategy: " << strategies[s].name() << " is fastest on every milestone\n";
+
+        if (cliffs.empty())
+            std::cout << "No pacing cliffs found for the best strategy\n";
+        for (const auto& cliff : cliffs)
+            std::cout << "Pacing cliff: " << cliff << "\n";
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}